@@ -47,6 +47,10 @@
         operator MyVec4() const { return MyVec4(x,y,z,w); }
 */
 
+//---- Use a compact 12 bytes vertex layout (16-bit fixed point positions relative to ImDrawList::VtxOrigin, 16-bit normalized UV) to reduce vertex upload bandwidth. See ImDrawVert in imgui.h.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS 3
+
 //---- Use 32-bit vertex indices (instead of default: 16-bit) to allow meshes with more than 64K vertices
 //#define ImDrawIdx unsigned int
 
@@ -51,7 +51,7 @@ struct ImDrawCmd;                   // A single draw command within a parent ImD
 struct ImDrawData;                  // All draw command lists required to render the frame
 struct ImDrawList;                  // A single draw command list (generally one per window)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
-struct ImDrawVert;                  // A single vertex (20 bytes by default, override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT, override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
@@ -1340,7 +1340,26 @@ typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT are mutually exclusive"
+#endif
+// Number of fractional bits of the fixed point positions (default: 1/8 pixel precision, +/- 4095 pixels around ImDrawList::VtxOrigin)
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS 3
+#endif
+// Compact vertex layout (12 bytes), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h
+// - pos: signed 16-bit fixed point with IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS fractional bits, relative to ImDrawList::VtxOrigin. Out of range positions are clamped.
+// - uv: normalized unsigned 16-bit (0 = 0.0f, 65535 = 1.0f). UV outside of the [0,1] range are clamped, so texture wrapping is not available.
+// Always write vertices with ImDrawList::PrimSetVtx() and read them back with ImDrawList::GetVtxPos()/GetVtxUV().
+// Your renderer needs to decode the position as (pos / (1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS)) + draw_list->VtxOrigin.
+struct ImDrawVert
+{
+    short           pos[2];
+    unsigned short  uv[2];
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -1394,6 +1413,9 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImVec2                  VtxOrigin;          // Origin of the fixed point vertex positions. Set by ImGui::Begin() to the window position, (0,0) after Clear().
+#endif
 
     // [Internal, used while building lists]
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
@@ -1469,11 +1491,26 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col){ _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col){ PrimSetVtx(_VtxWritePtr, pos, uv, col); _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                 { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)     { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); }
     IMGUI_API void  UpdateClipRect();
     IMGUI_API void  UpdateTextureID();
+
+    // Vertex accessors, independent of the vertex layout
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    inline    void  PrimSetVtx(ImDrawVert* vtx, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { vtx->pos[0] = EncodeVtxPos(pos.x - VtxOrigin.x); vtx->pos[1] = EncodeVtxPos(pos.y - VtxOrigin.y); vtx->uv[0] = EncodeVtxUV(uv.x); vtx->uv[1] = EncodeVtxUV(uv.y); vtx->col = col; }
+    inline    void  SetVtxUV(ImDrawVert* vtx, const ImVec2& uv) const           { vtx->uv[0] = EncodeVtxUV(uv.x); vtx->uv[1] = EncodeVtxUV(uv.y); }
+    inline    ImVec2 GetVtxPos(const ImDrawVert& vtx) const                     { const float s = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); return ImVec2(VtxOrigin.x + vtx.pos[0] * s, VtxOrigin.y + vtx.pos[1] * s); }
+    inline    ImVec2 GetVtxUV(const ImDrawVert& vtx) const                      { return ImVec2(vtx.uv[0] * (1.0f / 65535.0f), vtx.uv[1] * (1.0f / 65535.0f)); }
+    static inline short          EncodeVtxPos(float v)                          { v *= (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); return (short)(v <= -32767.0f ? -32767 : v >= 32767.0f ? 32767 : (int)(v + (v >= 0.0f ? 0.5f : -0.5f))); }
+    static inline unsigned short EncodeVtxUV(float v)                           { return (unsigned short)(v <= 0.0f ? 0 : v >= 1.0f ? 65535 : (int)(v * 65535.0f + 0.5f)); }
+#else
+    inline    void  PrimSetVtx(ImDrawVert* vtx, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { vtx->pos = pos; vtx->uv = uv; vtx->col = col; }
+    inline    void  SetVtxUV(ImDrawVert* vtx, const ImVec2& uv) const           { vtx->uv = uv; }
+    inline    ImVec2 GetVtxPos(const ImDrawVert& vtx) const                     { return vtx.pos; }
+    inline    ImVec2 GetVtxUV(const ImDrawVert& vtx) const                      { return vtx.uv; }
+#endif
 };
 
 // All draw data to render an ImGui frame
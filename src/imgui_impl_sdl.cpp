@@ -22,6 +22,7 @@ static int          g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
 static int          g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;
 static int          g_AttribLocationPosition = 0, g_AttribLocationUV = 0, g_AttribLocationColor = 0;
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
+static unsigned int g_UploadedBytes = 0;
 
 // This is the main rendering function that you have to implement and provide to ImGui (via setting up 'RenderDrawListsFn' in the ImGuiIO structure)
 // If text or lines are blurry when integrating ImGui in your engine:
@@ -65,7 +66,9 @@ void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data)
     };
     glUseProgram(g_ShaderHandle);
     glUniform1i(g_AttribLocationTex, 0);
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+#endif
 
     // Render command lists
     glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
@@ -74,21 +77,45 @@ void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data)
     glEnableVertexAttribArray(g_AttribLocationColor);
 
 #define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Fixed point positions are scaled and offset by the projection matrix, UVs are normalized by GL
+    glVertexAttribPointer(g_AttribLocationPosition, 2, GL_SHORT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationUV, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(g_AttribLocationPosition, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(g_AttribLocationUV, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(g_AttribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, col));
 #undef OFFSETOF
     
+    g_UploadedBytes = 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
         const ImDrawIdx* idx_buffer_offset = 0;
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Fold the fixed point scale and the draw list origin into the projection matrix
+        const float pos_scale = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS);
+        const float list_projection[4][4] =
+        {
+            { ortho_projection[0][0] * pos_scale, 0.0f, 0.0f, 0.0f },
+            { 0.0f, ortho_projection[1][1] * pos_scale, 0.0f, 0.0f },
+            { 0.0f, 0.0f, -1.0f, 0.0f },
+            { ortho_projection[3][0] + ortho_projection[0][0] * cmd_list->VtxOrigin.x, ortho_projection[3][1] + ortho_projection[1][1] * cmd_list->VtxOrigin.y, 0.0f, 1.0f },
+        };
+        glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &list_projection[0][0]);
+#endif
+
+        const GLsizeiptr vtx_size = (GLsizeiptr)cmd_list->VtxBuffer.size() * sizeof(ImDrawVert);
+        const GLsizeiptr idx_size = (GLsizeiptr)cmd_list->IdxBuffer.size() * sizeof(ImDrawIdx);
+        g_UploadedBytes += (unsigned int)(vtx_size + idx_size);
+
         glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.size() * sizeof(ImDrawVert), (GLvoid*)&cmd_list->VtxBuffer.front(), GL_STREAM_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, vtx_size, (GLvoid*)&cmd_list->VtxBuffer.front(), GL_STREAM_DRAW);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.size() * sizeof(ImDrawIdx), (GLvoid*)&cmd_list->IdxBuffer.front(), GL_STREAM_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_size, (GLvoid*)&cmd_list->IdxBuffer.front(), GL_STREAM_DRAW);
         
         for (const ImDrawCmd* pcmd = cmd_list->CmdBuffer.begin(); pcmd != cmd_list->CmdBuffer.end(); pcmd++)
         {
@@ -117,6 +144,11 @@ void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data)
     glDisable(GL_SCISSOR_TEST);
 }
 
+unsigned int ImGui_ImplSdl_GetUploadedBytes()
+{
+    return g_UploadedBytes;
+}
+
 static const char* ImGui_ImplSdl_GetClipboardText(void*)
 {
     return SDL_GetClipboardText();
@@ -11,4 +11,6 @@ IMGUI_API bool        ImGui_ImplSdl_ProcessEvent(SDL_Event* event);
 
 // Use if you want to reset your rendering device without losing ImGui state.
 IMGUI_API void        ImGui_ImplSdl_InvalidateDeviceObjects();
-IMGUI_API bool        ImGui_ImplSdl_CreateDeviceObjects();
\ No newline at end of file
+IMGUI_API bool        ImGui_ImplSdl_CreateDeviceObjects();
+// Number of vertex and index buffer bytes uploaded by the last ImGui_ImplSdl_RenderDrawLists() call.
+IMGUI_API unsigned int ImGui_ImplSdl_GetUploadedBytes();
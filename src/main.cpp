@@ -201,10 +201,15 @@ void main_loop()
     static glm::vec3 bgcolor(0.2f);
     ImGui::ColorEdit3("Triangle", glm::value_ptr(color));
     ImGui::ColorEdit3("Background", glm::value_ptr(bgcolor));
+
+    // Bytes sent through glBufferData() last frame, compare builds with and without IMGUI_USE_COMPACT_DRAWVERT
+    static bool g_show_test_window = false;
+    ImGui::Checkbox("Show ImGui demo window", &g_show_test_window);
+    ImGui::Text("Uploaded: %u bytes/frame (%d bytes/vertex)", ImGui_ImplSdl_GetUploadedBytes(), (int)sizeof(ImDrawVert));
     ImGui::End();
 
-    //static bool g_show_test_window = true;
-    //ImGui::ShowDemoWindow(&g_show_test_window);
+    if (g_show_test_window)
+        ImGui::ShowDemoWindow(&g_show_test_window);
     
     int w, h;
     SDL_GL_GetDrawableSize(g_window, &w, &h);